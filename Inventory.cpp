@@ -3,38 +3,66 @@
 #include <algorithm>
 #include <sstream>
 #include <iostream>
+#include <unordered_map>
 
 bool Inventory::loadFromFile(const std::string& path) {
     items.clear();
     std::ifstream in(path);
     if (!in.is_open()) return false;
 
+    if (store) store->clear();
+    rejected = 0;
+
     std::string line;
     while (std::getline(in, line)) {
         if (line.empty()) continue;
-        items.push_back(Item::fromCsv(line));
+        if (store) {
+            Item it = Item::fromCsv(line);
+            // ids <= 0 are reassigned like importCsv does, keeping 0 free as addItem's rejection value
+            if (it.id <= 0 || !store->insert(it)) {
+                it.id = store->maxId() + 1; // missing or duplicate id
+                if (!store->insert(it)) ++rejected; // record too large
+            }
+        } else {
+            items.push_back(Item::fromCsv(line));
+        }
     }
     recomputeNextId();
+    if (store) return store->flush();
     return true;
 }
 
 bool Inventory::saveToFile(const std::string& path) const {
     std::ofstream out(path, std::ios::trunc);
     if (!out.is_open()) return false;
-    for (const auto& it : items) {
-        out << it.toCsv() << '\n';
-    }
+    forEachItem([&](const Item& it) { out << it.toCsv() << '\n'; return true; });
+    return true;
+}
+
+bool Inventory::openStore(const std::string& path, size_t memoryBudget, bool& created) {
+    auto opened = std::make_unique<PagedStore>();
+    if (!opened->open(path, memoryBudget)) return false;
+    created = opened->wasCreated();
+    store = std::move(opened);
+    items.clear();
+    recomputeNextId();
     return true;
 }
 
 Item Inventory::addItem(const Item& item) {
     Item copy = item;
     copy.id = nextId++;
+    if (store) {
+        if (!store->insert(copy)) { --nextId; copy.id = 0; }
+        store->flush();
+        return copy;
+    }
     items.push_back(copy);
     return copy;
 }
 
 bool Inventory::removeItem(int id) {
+    if (store) return store->erase(id) && store->flush();
     auto newEnd = std::remove_if(items.begin(), items.end(), [&](const Item& i){ return i.id == id; });
     bool removed = (newEnd != items.end());
     if (removed) items.erase(newEnd, items.end());
@@ -42,18 +70,21 @@ bool Inventory::removeItem(int id) {
 }
 
 std::optional<Item> Inventory::getItem(int id) const {
+    if (store) return store->find(id);
     for (const auto& i : items) if (i.id == id) return i;
     return std::nullopt;
 }
 
 bool Inventory::updateItem(int id, const Item& updated) {
+    if (store) {
+        auto existing = store->find(id);
+        if (!existing) return false;
+        assignFields(*existing, updated);
+        return store->update(*existing) && store->flush();
+    }
     for (auto& i : items) {
         if (i.id == id) {
-            i.name = updated.name;
-            i.category = updated.category;
-            i.supplier = updated.supplier;
-            i.quantity = updated.quantity;
-            i.price = updated.price;
+            assignFields(i, updated);
             return true;
         }
     }
@@ -61,44 +92,207 @@ bool Inventory::updateItem(int id, const Item& updated) {
 }
 
 std::vector<Item> Inventory::listAll() const {
-    return items;
+    if (!store) return items;
+    std::vector<Item> out;
+    out.reserve(store->size());
+    forEachItem([&](const Item& i) { out.push_back(i); return true; });
+    return out;
+}
+
+std::vector<Item> Inventory::listFrom(int fromId, size_t count) const {
+    std::vector<Item> out;
+    if (count == 0) return out;
+    if (store) {
+        // the tree seeks straight to fromId, so paging by id cursor never rescans earlier pages
+        store->forEachFrom(fromId, [&](const Item& i) {
+            out.push_back(i);
+            return out.size() < count;
+        });
+        return out;
+    }
+    for (const auto& i : items) if (i.id >= fromId) out.push_back(i);
+    size_t n = std::min(count, out.size());
+    std::partial_sort(out.begin(), out.begin() + n, out.end(), [](const Item& a, const Item& b){ return a.id < b.id; });
+    out.resize(n);
+    return out;
+}
+
+size_t Inventory::size() const {
+    return store ? store->size() : items.size();
 }
 
 std::vector<Item> Inventory::searchByName(const std::string& term) const {
     std::vector<Item> out;
     std::string lowerTerm = term;
     std::transform(lowerTerm.begin(), lowerTerm.end(), lowerTerm.begin(), ::tolower);
-    for (const auto& i : items) {
+    forEachItem([&](const Item& i) {
         std::string name = i.name;
         std::transform(name.begin(), name.end(), name.begin(), ::tolower);
         if (name.find(lowerTerm) != std::string::npos) out.push_back(i);
-    }
+        return true;
+    });
     return out;
 }
 
 std::vector<Item> Inventory::lowStock(int threshold) const {
     std::vector<Item> out;
-    for (const auto& i : items) if (i.quantity <= threshold) out.push_back(i);
+    forEachItem([&](const Item& i) { if (i.quantity <= threshold) out.push_back(i); return true; });
     return out;
 }
 
 bool Inventory::importCsv(const std::string& path) {
     std::ifstream in(path);
     if (!in.is_open()) return false;
+    rejected = 0;
     std::string line;
     while (std::getline(in, line)) {
         if (line.empty()) continue;
         Item it = Item::fromCsv(line);
+        int savedNextId = nextId;
         // avoid ID collision: if id is zero or matches existing, reassign
         bool conflict = false;
-        for (const auto& existing : items) if (existing.id == it.id) { conflict = true; break; }
+        if (store) conflict = store->find(it.id).has_value();
+        else for (const auto& existing : items) if (existing.id == it.id) { conflict = true; break; }
         if (it.id <= 0 || conflict) {
             it.id = nextId++;
         } else {
             if (it.id >= nextId) nextId = it.id + 1;
         }
-        items.push_back(it);
+        if (store) {
+            if (!store->insert(it)) { nextId = savedNextId; ++rejected; }
+        } else {
+            items.push_back(it);
+        }
     }
+    if (store) return store->flush();
+    return true;
+}
+
+// Hash join: build a table of existing items by key, then probe it once per incoming row.
+// The table holds only a key hash, id and listing position per item, and name+supplier hits are
+// confirmed against the item since hashes can collide. An id merge against the paged store needs
+// no table at all: the B+-tree is the id index, and only matched ids are kept for deleteMissing.
+bool Inventory::mergeCsv(const std::string& path, MergeKey key, bool deleteMissing, MergeSummary& summary) {
+    std::ifstream in(path);
+    if (!in.is_open()) return false;
+    summary = MergeSummary{};
+
+    auto hashOf = [key](const Item& i) -> size_t {
+        if (key == MergeKey::Id) return static_cast<size_t>(i.id);
+        return std::hash<std::string>{}(i.name + '\x1f' + i.supplier);
+    };
+    auto sameKey = [key](const Item& a, const Item& b) {
+        return key == MergeKey::Id ? a.id == b.id : (a.name == b.name && a.supplier == b.supplier);
+    };
+
+    const bool probeTree = store && key == MergeKey::Id;
+    std::vector<int> matchedIds; // probeTree only
+
+    // pos is the item's place in listAll() order, i.e. its index into items when not paged
+    struct Entry { int id; size_t pos; bool matched; };
+    std::unordered_multimap<size_t, Entry> table;
+    size_t pos = 0;
+    if (!probeTree) {
+        table.reserve(size());
+        forEachItem([&](const Item& i) {
+            table.emplace(hashOf(i), Entry{ i.id, pos++, false });
+            return true;
+        });
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        Item row = Item::fromCsv(line);
+        // a row without an id (<= 0) has no key to match on and is always inserted
+        bool hasKey = key != MergeKey::Id || row.id > 0;
+
+        if (probeTree && hasKey && store->find(row.id)) {
+            if (deleteMissing) matchedIds.push_back(row.id);
+            if (store->update(row)) ++summary.updated;
+            else ++summary.skipped;
+            continue;
+        }
+
+        // every item sharing the key counts as matched (and is kept); the first one is updated
+        Entry* target = nullptr;
+        auto range = (hasKey && !probeTree) ? table.equal_range(hashOf(row)) : std::make_pair(table.end(), table.end());
+        for (auto it = range.first; it != range.second; ++it) {
+            Entry& e = it->second;
+            if (key == MergeKey::NameSupplier) {
+                if (store) {
+                    auto current = store->find(e.id);
+                    if (!current || !sameKey(*current, row)) continue;
+                } else if (!sameKey(items[e.pos], row)) {
+                    continue;
+                }
+            }
+            e.matched = true;
+            if (!target || e.pos < target->pos) target = &e;
+        }
+
+        if (target) {
+            if (store) {
+                Item merged = row;
+                merged.id = target->id;
+                if (!store->update(merged)) { ++summary.skipped; continue; }
+            } else {
+                assignFields(items[target->pos], row);
+            }
+            ++summary.updated;
+            continue;
+        }
+
+        // with an id key a miss means the id is free, so keep it
+        if (key == MergeKey::Id && row.id > 0) {
+            if (row.id >= nextId) nextId = row.id + 1;
+        } else {
+            row.id = nextId++;
+        }
+        if (store) {
+            if (!store->insert(row)) { ++summary.skipped; continue; }
+        } else {
+            items.push_back(row);
+        }
+        if (probeTree) {
+            if (deleteMissing) matchedIds.push_back(row.id);
+        } else {
+            table.emplace(hashOf(row), Entry{ row.id, pos++, true });
+        }
+        ++summary.inserted;
+    }
+
+    if (deleteMissing) {
+        if (probeTree) {
+            // the store walks in id order, so a sorted id list is enough to find the misses
+            std::sort(matchedIds.begin(), matchedIds.end());
+            std::vector<int> missing;
+            auto next = matchedIds.begin();
+            store->forEach([&](const Item& i) {
+                while (next != matchedIds.end() && *next < i.id) ++next;
+                if (next == matchedIds.end() || *next != i.id) missing.push_back(i.id);
+                return true;
+            });
+            for (int id : missing) if (store->erase(id)) ++summary.deleted;
+        } else if (store) {
+            for (const auto& [h, e] : table) {
+                if (!e.matched && store->erase(e.id)) ++summary.deleted;
+            }
+        } else {
+            // one compaction pass instead of removeItem per id
+            std::vector<bool> keep(items.size(), false);
+            for (const auto& [h, e] : table) if (e.matched) keep[e.pos] = true;
+            size_t out = 0;
+            for (size_t i = 0; i < items.size(); ++i) {
+                if (!keep[i]) continue;
+                if (out != i) items[out] = std::move(items[i]);
+                ++out;
+            }
+            summary.deleted = items.size() - out;
+            items.resize(out);
+        }
+    }
+    if (store) return store->flush();
     return true;
 }
 
@@ -107,7 +301,21 @@ bool Inventory::exportCsv(const std::string& path) const {
 }
 
 void Inventory::recomputeNextId() {
+    if (store) { nextId = store->maxId() + 1; return; }
     int maxId = 0;
     for (const auto& i : items) if (i.id > maxId) maxId = i.id;
     nextId = maxId + 1;
+}
+
+void Inventory::assignFields(Item& dst, const Item& src) {
+    dst.name = src.name;
+    dst.category = src.category;
+    dst.supplier = src.supplier;
+    dst.quantity = src.quantity;
+    dst.price = src.price;
+}
+
+void Inventory::forEachItem(const std::function<bool(const Item&)>& fn) const {
+    if (store) { store->forEach(fn); return; }
+    for (const auto& i : items) if (!fn(i)) return;
 }
\ No newline at end of file
@@ -1,8 +1,21 @@
 #pragma once
 #include "Item.h"
+#include "PagedStore.h"
 #include <vector>
 #include <string>
 #include <optional>
+#include <memory>
+#include <functional>
+
+enum class MergeKey { Id, NameSupplier };
+
+struct MergeSummary
+{
+    size_t updated = 0;
+    size_t inserted = 0;
+    size_t deleted = 0;
+    size_t skipped = 0; // rows the store could not hold
+};
 
 class Inventory
 {
@@ -11,20 +24,33 @@ public:
 
     bool loadFromFile(const std::string& path);
     bool saveToFile(const std::string& path) const;
+    // Switch to disk-backed paged storage; created reports a new store that still needs seeding.
+    bool openStore(const std::string& path, size_t memoryBudget, bool& created);
+    bool isPaged() const { return store != nullptr; }
 
-    Item addItem(const Item& item); // returns item with assigned id
+    Item addItem(const Item& item); // returns item with assigned id (0 if the store rejects it)
     bool removeItem(int id);
     std::optional<Item> getItem(int id) const;
     bool updateItem(int id, const Item& updated); // id is preserved
     std::vector<Item> listAll() const;
+    std::vector<Item> listFrom(int fromId, size_t count) const; // first count items with id >= fromId, by id
+    size_t size() const;
     std::vector<Item> searchByName(const std::string& term) const;
     std::vector<Item> lowStock(int threshold) const;
 
     bool importCsv(const std::string& path); // merges (skips duplicates id)
+    // Upsert: a row matching existing items on key updates the first of them in place (the rest
+    // are kept), other rows are inserted; deleteMissing drops items whose key is not in the file.
+    bool mergeCsv(const std::string& path, MergeKey key, bool deleteMissing, MergeSummary& summary);
     bool exportCsv(const std::string& path) const;
+    size_t rejectedCount() const { return rejected; } // rows the paged store refused in the last load/import
 
 private:
     std::vector<Item> items;
+    std::unique_ptr<PagedStore> store; // when set, items stay empty and the store holds everything
     int nextId = 1;
+    size_t rejected = 0;
     void recomputeNextId();
+    static void assignFields(Item& dst, const Item& src); // everything but id
+    void forEachItem(const std::function<bool(const Item&)>& fn) const;
 };
\ No newline at end of file
@@ -0,0 +1,149 @@
+// Standalone checks for Inventory::mergeCsv (not part of the app project, it has its own main).
+// Build and run from the project folder:
+//   g++ -std=c++20 InventoryMerge_test.cpp Inventory.cpp PagedStore.cpp -o merge_test && ./merge_test
+
+#include "Inventory.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+static int failures = 0;
+
+static void check(bool cond, const std::string& what) {
+    if (cond) return;
+    std::cout << "FAIL: " << what << '\n';
+    ++failures;
+}
+
+static const std::string basePath = "merge_test_base.csv";
+static const std::string feedPath = "merge_test_feed.csv";
+static const std::string storePath = "merge_test.db";
+
+static void writeFile(const std::string& path, const std::vector<std::string>& lines) {
+    std::ofstream out(path, std::ios::trunc);
+    for (const auto& l : lines) out << l << '\n';
+}
+
+// Loads the base file into a fresh inventory, in memory or through a new paged store.
+static void loadBase(Inventory& inv, bool paged) {
+    if (paged) {
+        std::remove(storePath.c_str());
+        bool created = false;
+        check(inv.openStore(storePath, 0, created) && created, "open merge store");
+    }
+    check(inv.loadFromFile(basePath), "load base");
+}
+
+static std::vector<std::string> snapshot(const Inventory& inv) {
+    auto items = inv.listAll();
+    std::sort(items.begin(), items.end(), [](const Item& a, const Item& b){ return a.id < b.id; });
+    std::vector<std::string> out;
+    for (const auto& i : items) out.push_back(i.toCsv());
+    return out;
+}
+
+static std::string describe(MergeKey key, bool paged, bool deleteMissing) {
+    return std::string(key == MergeKey::Id ? "id" : "name+supplier") + (paged ? " paged" : " memory")
+        + (deleteMissing ? " delete" : " keep");
+}
+
+static void testByNameSupplier(bool paged) {
+    writeFile(basePath, { "1,A,x,S,5,1", "2,A,x,S,3,2", "3,B,x,S,1,3", "4,C,x,T,1,4" });
+    // A,S repeats within the feed; C,S differs from C,T only by supplier
+    writeFile(feedPath, { "0,A,y,S,9,1", "0,A,z,S,8,1", "0,C,y,S,1,1" });
+    Inventory inv;
+    loadBase(inv, paged);
+    MergeSummary sum;
+    check(inv.mergeCsv(feedPath, MergeKey::NameSupplier, true, sum), "name+supplier merge runs");
+    check(sum.updated == 2 && sum.inserted == 1 && sum.deleted == 2, describe(MergeKey::NameSupplier, paged, true) + " counts");
+    // the first A,S item takes the last row for its key; its duplicate is kept untouched
+    std::vector<std::string> expected = { "1,A,z,S,8,1", "2,A,x,S,3,2", "5,C,y,S,1,1" };
+    check(snapshot(inv) == expected, describe(MergeKey::NameSupplier, paged, true) + " contents");
+}
+
+static void testById(bool paged) {
+    writeFile(basePath, { "1,A,x,S,5,1", "2,B,x,S,3,2", "3,C,x,S,1,3" });
+    // id 0 and negative ids are never matched, id 9 is free and kept, id 2 appears twice
+    writeFile(feedPath, { "2,B2,x,S,7,2", "0,N,x,S,1,1", "-4,M,x,S,1,1", "9,K,x,S,1,1", "2,B3,x,S,6,2" });
+    Inventory inv;
+    loadBase(inv, paged);
+    MergeSummary sum;
+    check(inv.mergeCsv(feedPath, MergeKey::Id, true, sum), "id merge runs");
+    check(sum.updated == 2 && sum.inserted == 3 && sum.deleted == 2, describe(MergeKey::Id, paged, true) + " counts");
+    std::vector<std::string> expected = { "2,B3,x,S,6,2", "4,N,x,S,1,1", "5,M,x,S,1,1", "9,K,x,S,1,1" };
+    check(snapshot(inv) == expected, describe(MergeKey::Id, paged, true) + " contents");
+    check(inv.addItem(Item{}).id == 10, describe(MergeKey::Id, paged, true) + " next id after merge");
+}
+
+// In memory, loadFromFile keeps id 0 as is; an id-less feed row must not overwrite that item.
+static void testIdlessRowNeverMatches() {
+    writeFile(basePath, { "0,orig,x,S,1,1", "1,A,x,S,1,1" });
+    writeFile(feedPath, { "0,z,x,S,2,2" });
+    Inventory inv;
+    loadBase(inv, false);
+    MergeSummary sum;
+    check(inv.mergeCsv(feedPath, MergeKey::Id, false, sum), "id-less merge runs");
+    check(sum.updated == 0 && sum.inserted == 1, "id-less row is inserted");
+    check(inv.getItem(0) && inv.getItem(0)->name == "orig", "id 0 item is untouched");
+    check(inv.getItem(2) && inv.getItem(2)->name == "z", "id-less row gets the next id");
+}
+
+// Random base and feed with small name/supplier pools so keys collide often; both storage
+// modes must agree on every summary count and on the final contents.
+static void testModesAgree() {
+    std::mt19937 rng(7);
+    const char* names[] = { "bolt", "nut", "washer", "screw", "rivet" };
+    const char* suppliers[] = { "acme", "bolts-r-us", "acme, inc" };
+    auto row = [&](int id) {
+        Item it;
+        it.id = id;
+        it.name = names[rng() % 5];
+        it.category = "c" + std::to_string(rng() % 3);
+        it.supplier = suppliers[rng() % 3];
+        it.quantity = static_cast<int>(rng() % 50);
+        it.price = 0.5;
+        return it.toCsv();
+    };
+
+    for (int round = 0; round < 20; ++round) {
+        std::vector<std::string> base, feed;
+        int id = 0;
+        for (int i = 0; i < 40; ++i) { id += 1 + static_cast<int>(rng() % 3); base.push_back(row(id)); }
+        for (int i = 0; i < 40; ++i) feed.push_back(row(static_cast<int>(rng() % (id + 10)) - 3));
+        writeFile(basePath, base);
+        writeFile(feedPath, feed);
+
+        for (MergeKey key : { MergeKey::Id, MergeKey::NameSupplier }) {
+            for (bool deleteMissing : { false, true }) {
+                Inventory memory, paged;
+                loadBase(memory, false);
+                loadBase(paged, true);
+                MergeSummary a, b;
+                check(memory.mergeCsv(feedPath, key, deleteMissing, a), "memory merge runs");
+                check(paged.mergeCsv(feedPath, key, deleteMissing, b), "paged merge runs");
+                std::string what = "round " + std::to_string(round) + " " + describe(key, true, deleteMissing);
+                check(a.updated == b.updated && a.inserted == b.inserted && a.deleted == b.deleted
+                      && a.skipped == b.skipped, what + ": summaries agree");
+                check(a.updated + a.inserted == feed.size(), what + ": every row accounted for");
+                check(snapshot(memory) == snapshot(paged), what + ": contents agree");
+            }
+        }
+    }
+}
+
+int main() {
+    for (bool paged : { false, true }) {
+        testByNameSupplier(paged);
+        testById(paged);
+    }
+    testIdlessRowNeverMatches();
+    testModesAgree();
+    std::remove(basePath.c_str());
+    std::remove(feedPath.c_str());
+    std::remove(storePath.c_str());
+
+    if (failures == 0) std::cout << "mergeCsv tests passed\n";
+    return failures == 0 ? 0 : 1;
+}
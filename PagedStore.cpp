@@ -0,0 +1,386 @@
+#include "PagedStore.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace {
+    constexpr uint32_t Magic = 0x50564E49; // "INVP"
+    constexpr size_t MinFrames = 8;        // enough for a root-to-leaf path plus splits
+    constexpr size_t NodeHeaderSize = 8;   // type, pad, count (u16), next (u32)
+    constexpr uint8_t LeafType = 1;
+    constexpr uint8_t InternalType = 2;
+
+    template <typename T>
+    void put(char* p, size_t& off, T v) { std::memcpy(p + off, &v, sizeof(T)); off += sizeof(T); }
+
+    template <typename T>
+    T get(const char* p, size_t& off) { T v; std::memcpy(&v, p + off, sizeof(T)); off += sizeof(T); return v; }
+}
+
+PagedStore::~PagedStore() {
+    close();
+}
+
+bool PagedStore::open(const std::string& filePath, size_t memoryBudget) {
+    close();
+    path = filePath;
+    created = false;
+    cleanOnDisk = false;
+    capacity = std::max(MinFrames, memoryBudget / PageSize);
+
+    file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        std::ofstream create(path, std::ios::binary); // fstream in|out does not create files
+        create.close();
+        file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+    }
+    if (!file.is_open()) return false;
+
+    file.seekg(0, std::ios::end);
+    std::streamoff length = file.tellg();
+    if (length == 0) {
+        created = true;
+        return initEmpty();
+    }
+    // anything else must already be a store; never overwrite e.g. a CSV picked by mistake
+    if (length < static_cast<std::streamoff>(PageSize)) {
+        file.close();
+        return false;
+    }
+
+    char buf[PageSize];
+    file.seekg(0);
+    file.read(buf, PageSize);
+    size_t off = 0;
+    if (!file || get<uint32_t>(buf, off) != Magic) {
+        file.close();
+        return false;
+    }
+    header.root = get<uint32_t>(buf, off);
+    header.pageCount = get<uint32_t>(buf, off);
+    header.itemCount = get<uint64_t>(buf, off);
+    header.maxKey = get<int32_t>(buf, off);
+    // pages may have been written after the header (crash or kill mid-operation): the tree cannot be trusted
+    if (get<uint32_t>(buf, off) == 0) {
+        file.close();
+        return false;
+    }
+    cleanOnDisk = true;
+    return true;
+}
+
+void PagedStore::close() {
+    if (!file.is_open()) return;
+    flush();
+    file.close();
+    lru.clear();
+    frames.clear();
+}
+
+bool PagedStore::flush() {
+    if (!file.is_open()) return false;
+    bool ok = true;
+    for (auto& f : lru) {
+        if (!f.dirty) continue;
+        if (writeBack(f)) f.dirty = false;
+        else ok = false;
+    }
+    return writeHeader(ok) && ok;
+}
+
+bool PagedStore::writeHeader(bool clean) {
+    char buf[PageSize] = {};
+    size_t off = 0;
+    put(buf, off, Magic);
+    put(buf, off, header.root);
+    put(buf, off, header.pageCount);
+    put(buf, off, header.itemCount);
+    put(buf, off, header.maxKey);
+    put(buf, off, static_cast<uint32_t>(clean ? 1 : 0));
+    file.clear();
+    file.seekp(0);
+    file.write(buf, PageSize);
+    file.flush();
+    cleanOnDisk = clean && file.good();
+    return file.good();
+}
+
+// Must precede any page write so an interrupted operation leaves a header open() will refuse.
+void PagedStore::markDirty() {
+    if (cleanOnDisk) writeHeader(false);
+}
+
+bool PagedStore::clear() {
+    if (!file.is_open()) return false;
+    lru.clear();
+    frames.clear();
+    file.close();
+    cleanOnDisk = false;
+    file.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    return initEmpty();
+}
+
+bool PagedStore::initEmpty() {
+    header = Header{};
+    header.pageCount = 1; // page 0 is the file header
+    header.root = allocatePage();
+    writeNode(header.root, Node{});
+    return flush();
+}
+
+bool PagedStore::insert(const Item& item) {
+    std::string record = item.toCsv();
+    if (record.size() > MaxRecordSize) return false;
+
+    bool inserted = false;
+    auto split = insertInto(header.root, item.id, record, inserted);
+    if (split) {
+        Node root;
+        root.leaf = false;
+        root.keys = { split->key };
+        root.children = { header.root, split->right };
+        uint32_t rootNo = allocatePage();
+        writeNode(rootNo, root);
+        header.root = rootNo;
+    }
+    if (inserted) {
+        ++header.itemCount;
+        if (item.id > header.maxKey) header.maxKey = item.id;
+    }
+    return inserted;
+}
+
+// Leaves are not merged when they underflow; empty leaves simply stay in the sibling chain.
+bool PagedStore::erase(int id) {
+    uint32_t leafNo = findLeaf(id);
+    Node node = readNode(leafNo);
+    auto pos = std::lower_bound(node.keys.begin(), node.keys.end(), id);
+    if (pos == node.keys.end() || *pos != id) return false;
+    size_t idx = pos - node.keys.begin();
+    node.keys.erase(pos);
+    node.records.erase(node.records.begin() + idx);
+    writeNode(leafNo, node);
+    --header.itemCount;
+    return true;
+}
+
+bool PagedStore::update(const Item& item) {
+    std::string record = item.toCsv();
+    if (record.size() > MaxRecordSize) return false;
+
+    uint32_t leafNo = findLeaf(item.id);
+    Node node = readNode(leafNo);
+    auto pos = std::lower_bound(node.keys.begin(), node.keys.end(), item.id);
+    if (pos == node.keys.end() || *pos != item.id) return false;
+    size_t idx = pos - node.keys.begin();
+    node.records[idx] = record;
+    if (encodedSize(node) <= PageSize) {
+        writeNode(leafNo, node);
+        return true;
+    }
+    // grown record no longer fits: reinsert so the leaf can split
+    return erase(item.id) && insert(item);
+}
+
+std::optional<Item> PagedStore::find(int id) {
+    Node node = readNode(findLeaf(id));
+    auto pos = std::lower_bound(node.keys.begin(), node.keys.end(), id);
+    if (pos == node.keys.end() || *pos != id) return std::nullopt;
+    return Item::fromCsv(node.records[pos - node.keys.begin()]);
+}
+
+void PagedStore::forEach(const std::function<bool(const Item&)>& fn) {
+    forEachFrom(std::numeric_limits<int>::min(), fn);
+}
+
+void PagedStore::forEachFrom(int id, const std::function<bool(const Item&)>& fn) {
+    Node node = readNode(findLeaf(id));
+    size_t i = std::lower_bound(node.keys.begin(), node.keys.end(), id) - node.keys.begin();
+    while (true) {
+        for (; i < node.records.size(); ++i) {
+            if (!fn(Item::fromCsv(node.records[i]))) return;
+        }
+        if (node.next == 0) break;
+        node = readNode(node.next);
+        i = 0;
+    }
+}
+
+char* PagedStore::fetch(uint32_t pageNo, bool forWrite) {
+    auto hit = frames.find(pageNo);
+    if (hit != frames.end()) {
+        lru.splice(lru.begin(), lru, hit->second);
+        if (forWrite) hit->second->dirty = true;
+        return hit->second->data.data();
+    }
+
+    if (lru.size() >= capacity) {
+        Frame& victim = lru.back();
+        if (victim.dirty) writeBack(victim);
+        frames.erase(victim.pageNo);
+        lru.pop_back();
+    }
+
+    lru.push_front(Frame{ pageNo, std::vector<char>(PageSize, 0), forWrite });
+    Frame& f = lru.front();
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(pageNo) * PageSize);
+    file.read(f.data.data(), PageSize);
+    file.clear(); // a short read leaves the zero-filled remainder
+    frames[pageNo] = lru.begin();
+    return f.data.data();
+}
+
+bool PagedStore::writeBack(const Frame& f) {
+    markDirty();
+    file.clear();
+    file.seekp(static_cast<std::streamoff>(f.pageNo) * PageSize);
+    file.write(f.data.data(), PageSize);
+    return file.good();
+}
+
+uint32_t PagedStore::allocatePage() {
+    uint32_t pageNo = header.pageCount++;
+    // extend the file now so pages evicted out of order never leave gaps
+    char zeros[PageSize] = {};
+    markDirty();
+    file.clear();
+    file.seekp(static_cast<std::streamoff>(pageNo) * PageSize);
+    file.write(zeros, PageSize);
+    return pageNo;
+}
+
+PagedStore::Node PagedStore::readNode(uint32_t pageNo) {
+    const char* p = fetch(pageNo, false);
+    Node node;
+    size_t off = 0;
+    uint8_t type = get<uint8_t>(p, off);
+    off += 1;
+    uint16_t count = get<uint16_t>(p, off);
+    node.next = get<uint32_t>(p, off);
+    node.leaf = (type != InternalType);
+    node.keys.reserve(count);
+    if (node.leaf) {
+        node.records.reserve(count);
+        for (uint16_t i = 0; i < count; ++i) {
+            node.keys.push_back(get<int32_t>(p, off));
+            uint16_t len = get<uint16_t>(p, off);
+            node.records.emplace_back(p + off, len);
+            off += len;
+        }
+    } else {
+        node.children.reserve(count + 1);
+        node.children.push_back(get<uint32_t>(p, off));
+        for (uint16_t i = 0; i < count; ++i) {
+            node.keys.push_back(get<int32_t>(p, off));
+            node.children.push_back(get<uint32_t>(p, off));
+        }
+    }
+    return node;
+}
+
+void PagedStore::writeNode(uint32_t pageNo, const Node& node) {
+    char* p = fetch(pageNo, true);
+    std::fill(p, p + PageSize, 0);
+    size_t off = 0;
+    put(p, off, node.leaf ? LeafType : InternalType);
+    off += 1;
+    put(p, off, static_cast<uint16_t>(node.keys.size()));
+    put(p, off, node.next);
+    if (node.leaf) {
+        for (size_t i = 0; i < node.keys.size(); ++i) {
+            put(p, off, node.keys[i]);
+            put(p, off, static_cast<uint16_t>(node.records[i].size()));
+            std::memcpy(p + off, node.records[i].data(), node.records[i].size());
+            off += node.records[i].size();
+        }
+    } else {
+        put(p, off, node.children[0]);
+        for (size_t i = 0; i < node.keys.size(); ++i) {
+            put(p, off, node.keys[i]);
+            put(p, off, node.children[i + 1]);
+        }
+    }
+}
+
+size_t PagedStore::encodedSize(const Node& node) {
+    size_t size = NodeHeaderSize;
+    if (node.leaf) {
+        for (const auto& r : node.records) size += sizeof(int32_t) + sizeof(uint16_t) + r.size();
+    } else {
+        size += sizeof(uint32_t) + node.keys.size() * (sizeof(int32_t) + sizeof(uint32_t));
+    }
+    return size;
+}
+
+uint32_t PagedStore::findLeaf(int32_t key) {
+    uint32_t pageNo = header.root;
+    Node node = readNode(pageNo);
+    while (!node.leaf) {
+        size_t idx = std::upper_bound(node.keys.begin(), node.keys.end(), key) - node.keys.begin();
+        pageNo = node.children[idx];
+        node = readNode(pageNo);
+    }
+    return pageNo;
+}
+
+std::optional<PagedStore::Split> PagedStore::insertInto(uint32_t pageNo, int32_t key, const std::string& record, bool& inserted) {
+    Node node = readNode(pageNo);
+
+    if (node.leaf) {
+        auto pos = std::lower_bound(node.keys.begin(), node.keys.end(), key);
+        if (pos != node.keys.end() && *pos == key) return std::nullopt; // duplicate id
+        size_t idx = pos - node.keys.begin();
+        node.keys.insert(pos, key);
+        node.records.insert(node.records.begin() + idx, record);
+        inserted = true;
+        if (encodedSize(node) <= PageSize) {
+            writeNode(pageNo, node);
+            return std::nullopt;
+        }
+
+        // split by bytes so both halves fit regardless of record sizes
+        size_t half = (encodedSize(node) - NodeHeaderSize) / 2;
+        size_t acc = 0, mid = 0;
+        while (mid + 1 < node.keys.size() && acc < half) {
+            acc += sizeof(int32_t) + sizeof(uint16_t) + node.records[mid].size();
+            ++mid;
+        }
+        Node right;
+        right.next = node.next;
+        right.keys.assign(node.keys.begin() + mid, node.keys.end());
+        right.records.assign(node.records.begin() + mid, node.records.end());
+        node.keys.resize(mid);
+        node.records.resize(mid);
+        uint32_t rightNo = allocatePage();
+        node.next = rightNo;
+        writeNode(pageNo, node);
+        writeNode(rightNo, right);
+        return Split{ right.keys.front(), rightNo };
+    }
+
+    size_t idx = std::upper_bound(node.keys.begin(), node.keys.end(), key) - node.keys.begin();
+    auto split = insertInto(node.children[idx], key, record, inserted);
+    if (!split) return std::nullopt;
+
+    node.keys.insert(node.keys.begin() + idx, split->key);
+    node.children.insert(node.children.begin() + idx + 1, split->right);
+    if (encodedSize(node) <= PageSize) {
+        writeNode(pageNo, node);
+        return std::nullopt;
+    }
+
+    size_t mid = node.keys.size() / 2;
+    Node right;
+    right.leaf = false;
+    int32_t upKey = node.keys[mid];
+    right.keys.assign(node.keys.begin() + mid + 1, node.keys.end());
+    right.children.assign(node.children.begin() + mid + 1, node.children.end());
+    node.keys.resize(mid);
+    node.children.resize(mid + 1);
+    uint32_t rightNo = allocatePage();
+    writeNode(pageNo, node);
+    writeNode(rightNo, right);
+    return Split{ upKey, rightNo };
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "Item.h"
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Disk-backed item storage for inventories larger than RAM.
+// Items live in fixed-size pages organised as a B+-tree keyed on id; pages are
+// accessed through a buffer pool whose size is capped by a memory budget (LRU eviction).
+class PagedStore
+{
+public:
+    static constexpr size_t PageSize = 4096;
+    static constexpr size_t MaxRecordSize = PageSize / 4; // a leaf always holds several records
+
+    PagedStore() = default;
+    ~PagedStore();
+    PagedStore(const PagedStore&) = delete;
+    PagedStore& operator=(const PagedStore&) = delete;
+
+    // Creates the file if missing or empty; rejects non-store files and stores that were not closed cleanly.
+    bool open(const std::string& path, size_t memoryBudget);
+    void close();
+    bool flush(); // writes dirty pages and marks the file clean
+    bool clear(); // drops every item
+
+    bool insert(const Item& item); // fails on duplicate id or oversized record
+    bool erase(int id);
+    bool update(const Item& item); // replaces the item with the same id
+    std::optional<Item> find(int id);
+    void forEach(const std::function<bool(const Item&)>& fn); // ascending id; return false to stop
+    void forEachFrom(int id, const std::function<bool(const Item&)>& fn); // same, starting at the first id >= id
+
+    size_t size() const { return header.itemCount; }
+    bool wasCreated() const { return created; } // true if open() had to initialise the file
+    int maxId() const { return header.maxKey; }
+
+private:
+    struct Header {
+        uint32_t root = 0;
+        uint32_t pageCount = 0;
+        uint64_t itemCount = 0;
+        int32_t maxKey = 0;
+    };
+
+    // Decoded form of a tree page; leaves use records, internal nodes use children.
+    struct Node {
+        bool leaf = true;
+        uint32_t next = 0; // right sibling of a leaf, 0 if none
+        std::vector<int32_t> keys;
+        std::vector<std::string> records;
+        std::vector<uint32_t> children; // keys.size() + 1 entries
+    };
+
+    struct Split {
+        int32_t key;
+        uint32_t right;
+    };
+
+    struct Frame {
+        uint32_t pageNo;
+        std::vector<char> data;
+        bool dirty;
+    };
+
+    std::string path;
+    std::fstream file;
+    Header header;
+    size_t capacity = 0;
+    bool created = false;
+    bool cleanOnDisk = false; // header on disk says every page write has completed
+    std::list<Frame> lru; // most recently used first
+    std::unordered_map<uint32_t, std::list<Frame>::iterator> frames;
+
+    bool initEmpty();
+    bool writeHeader(bool clean);
+    void markDirty();
+    char* fetch(uint32_t pageNo, bool forWrite);
+    bool writeBack(const Frame& f);
+    uint32_t allocatePage();
+
+    Node readNode(uint32_t pageNo);
+    void writeNode(uint32_t pageNo, const Node& node);
+    static size_t encodedSize(const Node& node);
+    uint32_t findLeaf(int32_t key);
+    std::optional<Split> insertInto(uint32_t pageNo, int32_t key, const std::string& record, bool& inserted);
+};
@@ -0,0 +1,171 @@
+// Standalone checks for PagedStore (not part of the app project, it has its own main).
+// Build and run from the project folder:
+//   g++ -std=c++20 PagedStore_test.cpp PagedStore.cpp -o pagedstore_test && ./pagedstore_test
+
+#include "PagedStore.h"
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <random>
+
+static int failures = 0;
+
+static void check(bool cond, const std::string& what) {
+    if (cond) return;
+    std::cout << "FAIL: " << what << '\n';
+    ++failures;
+}
+
+static Item makeItem(int id, const std::string& name) {
+    Item it;
+    it.id = id;
+    it.name = name;
+    it.category = "cat";
+    it.supplier = "sup, \"quoted\"";
+    it.quantity = id % 100;
+    it.price = 1.25;
+    return it;
+}
+
+// Walks the store and compares it to the reference map in id order.
+static bool matches(PagedStore& store, const std::map<int, Item>& ref) {
+    if (store.size() != ref.size()) return false;
+    auto expected = ref.begin();
+    bool ok = true;
+    store.forEach([&](const Item& it) {
+        if (expected == ref.end() || it.id != expected->first || it.name != expected->second.name
+            || it.supplier != expected->second.supplier || it.quantity != expected->second.quantity) {
+            ok = false;
+            return false;
+        }
+        ++expected;
+        return true;
+    });
+    return ok && expected == ref.end();
+}
+
+static void testRandomOpsAndReopen(const std::string& path) {
+    std::remove(path.c_str());
+    std::map<int, Item> ref;
+    std::mt19937 rng(42);
+    {
+        PagedStore store;
+        check(store.open(path, 0) && store.wasCreated(), "open creates a new store");
+        // minimum pool size forces evictions; long names force many leaf and internal splits
+        for (int i = 1; i <= 20000; ++i) {
+            Item it = makeItem(i, "item" + std::to_string(i) + std::string(rng() % 300, 'x'));
+            check(store.insert(it), "insert " + std::to_string(i));
+            ref[i] = it;
+        }
+        check(!store.insert(makeItem(5, "dup")), "duplicate id is refused");
+        for (int i = 0; i < 8000; ++i) {
+            int id = 1 + static_cast<int>(rng() % 20000);
+            check(store.erase(id) == (ref.erase(id) > 0), "erase " + std::to_string(id));
+        }
+        for (int i = 0; i < 2000; ++i) {
+            int id = 1 + static_cast<int>(rng() % 20000);
+            Item it = makeItem(id, std::string(rng() % 900, 'y'));
+            bool present = ref.count(id) > 0;
+            check(store.update(it) == present, "update " + std::to_string(id));
+            if (present) ref[id] = it;
+        }
+        check(matches(store, ref), "contents match after random operations");
+    }
+
+    PagedStore reopened;
+    check(reopened.open(path, 64 * 1024) && !reopened.wasCreated(), "reopen existing store");
+    check(matches(reopened, ref), "contents match after reopen");
+    check(reopened.maxId() == 20000, "max id survives reopen");
+
+    // seeking into the middle, including ids that were erased, resumes at the next live id
+    for (int from : { 1, 777, 10001, 19999, 25000 }) {
+        auto expected = ref.lower_bound(from);
+        bool ok = true;
+        int seen = 0;
+        reopened.forEachFrom(from, [&](const Item& it) {
+            if (expected == ref.end() || it.id != expected->first) { ok = false; return false; }
+            ++expected;
+            return ++seen < 50;
+        });
+        check(ok && (seen == 50 || expected == ref.end()), "forEachFrom " + std::to_string(from));
+    }
+}
+
+static void testUpdateGrowsPastPage(const std::string& path) {
+    std::remove(path.c_str());
+    PagedStore store;
+    check(store.open(path, 0), "open for growth test");
+    // fill a single leaf close to the page size with small records
+    std::map<int, Item> ref;
+    int id = 1;
+    while (true) {
+        Item it = makeItem(id, std::string(100, 'a'));
+        store.insert(it);
+        ref[id] = it;
+        if (ref.size() * 140 > PagedStore::PageSize - 200) break;
+        ++id;
+    }
+    Item grown = makeItem(2, std::string(PagedStore::MaxRecordSize - 60, 'g'));
+    check(store.update(grown), "update growing a record past the page size");
+    ref[2] = grown;
+    check(matches(store, ref), "contents match after growing update");
+    check(store.find(2) && store.find(2)->name == grown.name, "grown record is found");
+
+    Item oversized = makeItem(3, std::string(PagedStore::MaxRecordSize, 'o'));
+    check(!store.update(oversized), "oversized update is refused");
+    check(!store.insert(makeItem(99999, std::string(PagedStore::MaxRecordSize, 'o'))), "oversized insert is refused");
+}
+
+static void testFlushPersistsHeader(const std::string& path) {
+    std::remove(path.c_str());
+    PagedStore store;
+    check(store.open(path, 0), "open for flush test");
+    for (int i = 1; i <= 3000; ++i) store.insert(makeItem(i, "flushed"));
+    check(store.flush(), "flush");
+
+    // a second reader sees exactly what is on disk, as after a crash
+    PagedStore reader;
+    check(reader.open(path, 0), "open flushed store");
+    size_t walked = 0;
+    reader.forEach([&](const Item&) { ++walked; return true; });
+    check(reader.size() == 3000 && walked == 3000, "header and tree agree after flush");
+}
+
+static void testRejectsUnflushedStore(const std::string& path) {
+    std::remove(path.c_str());
+    PagedStore store;
+    check(store.open(path, 0), "open for dirty test");
+    // the minimum pool evicts pages long before the header would be written
+    for (int i = 1; i <= 3000; ++i) store.insert(makeItem(i, "unflushed"));
+
+    PagedStore reader;
+    check(!reader.open(path, 0), "store with unflushed writes is rejected");
+    check(store.flush(), "flush after dirty test");
+    check(reader.open(path, 0) && reader.size() == 3000, "store opens once flushed");
+}
+
+static void testRejectsForeignFile(const std::string& path) {
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "1,apple,fruit,acme,5,1\n";
+    }
+    PagedStore store;
+    check(!store.open(path, 0), "short non-store file is rejected");
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    check(line == "1,apple,fruit,acme,5,1", "rejected file is left untouched");
+}
+
+int main() {
+    const std::string path = "pagedstore_test.db";
+    testRandomOpsAndReopen(path);
+    testUpdateGrowsPastPage(path);
+    testFlushPersistsHeader(path);
+    testRejectsUnflushedStore(path);
+    testRejectsForeignFile(path);
+    std::remove(path.c_str());
+
+    if (failures == 0) std::cout << "PagedStore tests passed\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -18,8 +18,12 @@ struct Settings {
     bool autosave = false;
     std::string sortField = "id"; // id, name, category, supplier, quantity, price
     std::string configFile = "config.json"; // new line for config file
+    std::string storeFile; // paged on-disk store; empty keeps all items in memory
+    int memoryBudgetMb = 64; // buffer pool cap for the paged store
 } settings;
 
+static std::string activeStore; // store actually opened at startup; storeFile changes apply on restart
+
 static void pause() {
     std::cout << "Press Enter to continue...";
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -55,12 +59,32 @@ static void printItemRow(const Item& it) {
               << std::fixed << std::setprecision(2) << it.price << '\n';
 }
 
-static void showHeader() {
+static void reportRejected(const Inventory& inv) {
+    if (inv.rejectedCount() == 0) return;
+    std::cout << inv.rejectedCount() << " row(s) too large for the store were skipped.\n";
+}
+
+static void showHeader(const Inventory& inv) {
     std::cout << "=== Inventory Management ===\n";
     std::cout << "Data file: " << settings.dataFile
               << " | Page size: " << settings.pageSize
               << " | Autosave: " << (settings.autosave ? "On" : "Off")
-              << " | Sort: " << settings.sortField << "\n\n";
+              << " | Sort: " << (inv.isPaged() ? "id (paged store)" : settings.sortField);
+    if (inv.isPaged()) std::cout << " | Store: " << activeStore;
+    std::cout << "\n\n";
+}
+
+static void printColumnHeader() {
+    std::cout << std::left << std::setw(5) << "ID" << std::setw(20) << "Name" << std::setw(15) << "Category"
+              << std::setw(12) << "Supplier" << std::setw(8) << "Qty" << "Price\n";
+}
+
+// Common top of a list page: title bar, column names and a rule.
+static void showListTop(const Inventory& inv) {
+    clearScreen();
+    showHeader(inv);
+    printColumnHeader();
+    std::cout << std::string(70, '-') << '\n';
 }
 
 static std::string toLower(std::string s) {
@@ -84,7 +108,50 @@ static void sortItems(std::vector<Item>& items, const std::string& field) {
     }
 }
 
+// Paged stores may not fit in memory, so only the current page is fetched (always id order).
+// Pages are addressed by id cursor: starts[p] is the lowest id page p may show.
+static void listPagedUI(Inventory& inv) {
+    int total = static_cast<int>(inv.size());
+    if (total == 0) {
+        std::cout << "Inventory is empty.\n";
+        pause();
+        return;
+    }
+
+    int pageSize = std::max(1, settings.pageSize);
+    int pages = (total + pageSize - 1) / pageSize;
+    int page = 0;
+    std::vector<int> starts{ std::numeric_limits<int>::min() };
+
+    // walks forward from the last known page, so reaching page p reads each earlier item once
+    auto reach = [&](int p) {
+        while (static_cast<int>(starts.size()) <= p) {
+            auto chunk = inv.listFrom(starts.back(), pageSize);
+            if (static_cast<int>(chunk.size()) < pageSize || chunk.back().id == std::numeric_limits<int>::max()) return false;
+            starts.push_back(chunk.back().id + 1);
+        }
+        return true;
+    };
+
+    while (true) {
+        showListTop(inv);
+        for (const auto& it : inv.listFrom(starts[page], pageSize)) printItemRow(it);
+
+        std::cout << "\nPage " << (page + 1) << " / " << pages << "  (id order; Enter=next, b=prev, g=goto, q=quit)\n";
+        std::string cmd = readLine("Command: ");
+        if (cmd.empty() || cmd == "\n") { if (page + 1 >= pages || !reach(page + 1)) break; page++; }
+        else if (cmd == "b") { if (page > 0) --page; }
+        else if (cmd == "q") break;
+        else if (cmd == "g") {
+            int p = readInt("Goto page #: ") - 1;
+            if (p >= 0 && p < pages && reach(p)) page = p;
+        }
+    }
+}
+
 static void listUI(Inventory& inv) {
+    if (inv.isPaged()) { listPagedUI(inv); return; }
+
     auto items = inv.listAll();
     if (items.empty()) {
         std::cout << "Inventory is empty.\n";
@@ -100,11 +167,7 @@ static void listUI(Inventory& inv) {
     int page = 0;
 
     while (true) {
-        clearScreen();
-        showHeader();
-        std::cout << std::left << std::setw(5) << "ID" << std::setw(20) << "Name" << std::setw(15) << "Category"
-                  << std::setw(12) << "Supplier" << std::setw(8) << "Qty" << "Price\n";
-        std::cout << std::string(70, '-') << '\n';
+        showListTop(inv);
 
         int start = page * pageSize;
         int end = std::min(total, start + pageSize);
@@ -137,13 +200,15 @@ static void listUI(Inventory& inv) {
 static void settingsUI(Inventory& inv) {
     while (true) {
         clearScreen();
-        showHeader();
+        showHeader(inv);
         std::cout << "Settings\n";
         std::cout << "1) Data file: " << settings.dataFile << '\n';
         std::cout << "2) Page size: " << settings.pageSize << '\n';
         std::cout << "3) Autosave: " << (settings.autosave ? "On" : "Off") << '\n';
         std::cout << "4) Reload data file now\n";
         std::cout << "5) Config file: " << settings.configFile << '\n'; // new config option
+        std::cout << "6) Store file: " << (settings.storeFile.empty() ? "(in memory)" : settings.storeFile) << '\n';
+        std::cout << "7) Store memory budget (MB): " << settings.memoryBudgetMb << '\n';
         std::cout << "0) Back\n";
         std::string c = readLine("Choose: ");
         if (c == "1") {
@@ -152,6 +217,7 @@ static void settingsUI(Inventory& inv) {
                 settings.dataFile = p;
                 inv.loadFromFile(settings.dataFile);
                 std::cout << "Loaded " << settings.dataFile << '\n';
+                reportRejected(inv);
                 pause();
             }
         } else if (c == "2") {
@@ -163,6 +229,7 @@ static void settingsUI(Inventory& inv) {
             pause();
         } else if (c == "4") {
             if (inv.loadFromFile(settings.dataFile)) std::cout << "Reloaded.\n"; else std::cout << "Reload failed.\n";
+            reportRejected(inv);
             pause();
         } else if (c == "5") { // config file handling
             std::string newConfig = readLine("Enter new config file path: ");
@@ -171,13 +238,19 @@ static void settingsUI(Inventory& inv) {
                 std::cout << "Config file set to " << settings.configFile << '\n';
                 pause();
             }
+        } else if (c == "6") {
+            std::string p = readLine("Store file path (takes effect on restart, '-' for in memory): ");
+            if (p == "-") settings.storeFile.clear();
+            else if (!p.empty()) settings.storeFile = p;
+        } else if (c == "7") {
+            int mb = readInt("Memory budget in MB (takes effect on restart): ");
+            settings.memoryBudgetMb = std::max(1, mb);
         } else if (c == "0") break;
     }
 }
 
 int main() {
     Inventory inv;
-    inv.loadFromFile(settings.dataFile); // ignore failure (file may not exist)
 
     // Persist settings: load from config file if exists
     if (std::ifstream configIn(settings.configFile)) {
@@ -187,12 +260,32 @@ int main() {
         settings.pageSize = j.value("pageSize", settings.pageSize);
         settings.autosave = j.value("autosave", settings.autosave);
         settings.sortField = j.value("sortField", settings.sortField);
+        settings.storeFile = j.value("storeFile", settings.storeFile);
+        settings.memoryBudgetMb = j.value("memoryBudgetMb", settings.memoryBudgetMb);
         configIn.close();
     }
 
+    bool storeCreated = false;
+    if (!settings.storeFile.empty() &&
+        inv.openStore(settings.storeFile, static_cast<size_t>(settings.memoryBudgetMb) * 1024 * 1024, storeCreated)) {
+        activeStore = settings.storeFile;
+        if (storeCreated && inv.loadFromFile(settings.dataFile) && inv.rejectedCount() > 0) { // seed a new store from the CSV
+            reportRejected(inv);
+            pause();
+        }
+    } else {
+        if (!settings.storeFile.empty()) {
+            std::cout << "Could not open store file " << settings.storeFile
+                      << " (not a store, or not closed cleanly; delete it to rebuild from the data file).\n"
+                      << "Working in memory from " << settings.dataFile << "; changes are kept only when saved.\n";
+            pause();
+        }
+        inv.loadFromFile(settings.dataFile); // ignore failure (file may not exist)
+    }
+
     while (true) {
         clearScreen();
-        showHeader();
+        showHeader(inv);
         std::cout << "1) List all items\n"
                   << "2) Add item\n"
                   << "3) Update item\n"
@@ -203,7 +296,9 @@ int main() {
                   << "8) Export CSV\n"
                   << "9) Save and Exit\n"
                   << "10) Settings\n"
-                  << "0) Exit without saving\n"
+                  // the paged store is written as edits happen, so there is nothing to discard
+                  << (inv.isPaged() ? "0) Exit (changes are already in the store; data file not updated)\n"
+                                    : "0) Exit without saving\n")
                   << "Select: ";
         std::string choice;
         std::getline(std::cin, choice);
@@ -218,7 +313,8 @@ int main() {
             it.quantity = readInt("Quantity: ");
             it.price = readDouble("Price: ");
             Item added = inv.addItem(it);
-            std::cout << "Added with ID " << added.id << '\n';
+            if (added.id == 0) std::cout << "Item is too large for the store; not added.\n";
+            else std::cout << "Added with ID " << added.id << '\n';
             if (settings.autosave) inv.saveToFile(settings.dataFile);
             pause();
         } else if (choice == "3") {
@@ -250,8 +346,7 @@ int main() {
             std::string term = readLine("Search term: ");
             auto results = inv.searchByName(term);
             if (results.empty()) std::cout << "No matches.\n"; else {
-                std::cout << std::left << std::setw(5) << "ID" << std::setw(20) << "Name" << std::setw(15) << "Category"
-                          << std::setw(12) << "Supplier" << std::setw(8) << "Qty" << "Price\n";
+                printColumnHeader();
                 for (const auto& it : results) printItemRow(it);
             }
             pause();
@@ -260,14 +355,28 @@ int main() {
             auto list = inv.lowStock(thresh);
             if (list.empty()) std::cout << "No items at or below threshold.\n";
             else {
-                std::cout << std::left << std::setw(5) << "ID" << std::setw(20) << "Name" << std::setw(15) << "Category"
-                          << std::setw(12) << "Supplier" << std::setw(8) << "Qty" << "Price\n";
+                printColumnHeader();
                 for (const auto& it : list) printItemRow(it);
             }
             pause();
         } else if (choice == "7") {
             std::string path = readLine("CSV path to import: ");
-            if (inv.importCsv(path)) std::cout << "Imported.\n"; else std::cout << "Import failed.\n";
+            std::cout << "Mode: 1) append 2) merge by id 3) merge by name+supplier\n";
+            std::string mode = readLine("Choose: ");
+            if (mode == "2" || mode == "3") {
+                MergeKey key = (mode == "2") ? MergeKey::Id : MergeKey::NameSupplier;
+                bool prune = toLower(readLine("Delete items missing from the file? (y/N): ")) == "y";
+                MergeSummary sum;
+                if (inv.mergeCsv(path, key, prune, sum)) {
+                    std::cout << "Merged: " << sum.updated << " updated, " << sum.inserted << " inserted, "
+                              << sum.deleted << " deleted";
+                    if (sum.skipped) std::cout << ", " << sum.skipped << " skipped";
+                    std::cout << ".\n";
+                } else std::cout << "Import failed.\n";
+            } else {
+                if (inv.importCsv(path)) std::cout << "Imported.\n"; else std::cout << "Import failed.\n";
+                reportRejected(inv);
+            }
             if (settings.autosave) inv.saveToFile(settings.dataFile);
             pause();
         } else if (choice == "8") {
@@ -294,6 +403,8 @@ int main() {
     j["pageSize"] = settings.pageSize;
     j["autosave"] = settings.autosave;
     j["sortField"] = settings.sortField;
+    j["storeFile"] = settings.storeFile;
+    j["memoryBudgetMb"] = settings.memoryBudgetMb;
     std::ofstream configOut(settings.configFile);
     configOut << j.dump(4);
     configOut.close();